@@ -1,30 +1,42 @@
 
 //!  Namespace that handles callback bindings
 namespace Callback {
-    //!  Anonymous namespace with callback binding functions
+    /**
+     *  @brief Callback IDs
+     *  Every callback list has a dense ID, the builtin ones are listed here. Names used with Bind
+     *  are interned once and get the next free ID, so dispatch is an array lookup.
+     *  @see GetId(string szCallback)
+     */
     enum CallBacks {
-        LOAD = "Load", ///< Load
-        UNLOAD = "Unload", ///<Unload
-        EXIT = "Exit", ///<Exit
-        TICK = "Tick", ///<Tick
-        DRAW = "Draw", ///<Draw
-        RESET = "Reset", ///<Reset
-        SEND_CHAT = "SendChat", ///<SendChat
-        RECV_CHAT = "RecvChat", ///<RecvChat
-        WND_MSG = "WndMsg", ///<WndMsg
-        CREATE_OBJ = "CreateObj", ///<CreateObj
-        DELETE_OBJ = "DeleteObj", ///<DeleteObj
-        UPDATE_OBJ = "UpdateObj", ///<UpdateObj
-        PROCESS_SPELL = "ProcessSpell", ///<ProcessSpell
-        SEND_PACKET = "SendPacket", ///<SendPacket
-        RECV_PACKET = "RecvPacket", ///<RecvPacket
-        CRASH = "Crash", ///<BugSplat
-        ANIMATION = "Animation", ///<Animation
-        NOTIFY = "Notify", ///<Notify
-        APPLY_PARTICLE = "ApplyParticle", ///<ApplyParticle
+        LOAD = 0, ///< Load
+        UNLOAD = 1, ///<Unload
+        EXIT = 2, ///<Exit
+        TICK = 3, ///<Tick
+        DRAW = 4, ///<Draw
+        RESET = 5, ///<Reset
+        SEND_CHAT = 6, ///<SendChat
+        RECV_CHAT = 7, ///<RecvChat
+        WND_MSG = 8, ///<WndMsg
+        CREATE_OBJ = 9, ///<CreateObj
+        DELETE_OBJ = 10, ///<DeleteObj
+        UPDATE_OBJ = 11, ///<UpdateObj
+        PROCESS_SPELL = 12, ///<ProcessSpell
+        SEND_PACKET = 13, ///<SendPacket
+        RECV_PACKET = 14, ///<RecvPacket
+        CRASH = 15, ///<BugSplat
+        ANIMATION = 16, ///<Animation
+        NOTIFY = 17, ///<Notify
+        APPLY_PARTICLE = 18, ///<ApplyParticle
         CALLBACK_COUNT = 19, ///<19
     };
 
+    //!  Handler priorities, a dispatch runs the handlers in this order (bind order within a priority)
+    enum Priority {
+        PRIORITY_HIGH = 0, ///< Runs first, always runs
+        PRIORITY_NORMAL = 1, ///< Default, skipped when the budget is exceeded
+        PRIORITY_LOW = 2, ///< Runs last, skipped when the budget is exceeded
+    };
+
     //!  Class used by callback functions.
     class callbackFunction {
         public:
@@ -81,13 +93,71 @@ namespace Callback {
      *  @endcode
      */
     bool Bind(string szCallback, callbackFunction fnc);
-    /// Binds a callback
-    bool Bind(CallBacks eCallback, callbackFunction fnc);
-    /// Unbinds a callback
+    /// Binds a callback by ID (a CallBacks value or the result of GetId)
+    bool Bind(int iCallback, callbackFunction fnc);
+    /**
+     *  @brief Binds a callback with a priority
+     *  @see SetBudget(string szCallback, float fBudget)
+     */
+    bool Bind(string szCallback, callbackFunction fnc, Priority ePriority);
+    /// Binds a callback by ID with a priority
+    bool Bind(int iCallback, callbackFunction fnc, Priority ePriority);
+    /**
+     *  @brief Unbinds a callback
+     *  The handler lists are copy on write, binding or unbinding while a list is triggered
+     *  takes effect from the next Trigger.
+     */
     bool Unbind(string szCallback, callbackFunction fnc);
+    /// Unbinds a callback
+    bool Unbind(int iCallback, callbackFunction fnc);
     /// Triggers a callback list
     bool Trigger(string szCallback, object param1);
+    /// Triggers a callback list, without the name lookup
+    bool Trigger(int iCallback, object param1);
     /// Returns a callback list
     ipairs<callbackFunction> GetCallbacks(string szCallback);
+    /// Returns a callback list
+    ipairs<callbackFunction> GetCallbacks(int iCallback);
+    /**
+     *  @brief Returns the ID of a callback name, interning it if it is new
+     *  Builtin names return their CallBacks value, new names get IDs from CALLBACK_COUNT on.
+     *  Every function taking a callback name also takes the ID.
+     *  @code
+     *  local MY_EVENT = Callback.GetId("MyEvent")
+     *  Callback.Trigger(MY_EVENT, data)
+     *  @endcode
+     */
+    int GetId(string szCallback);
+    /// Returns the name of a callback ID
+    string GetName(int iCallback);
+    /**
+     *  @brief Sets the time budget of a callback list
+     *  Handlers run by priority (HIGH, NORMAL, then LOW). When the handlers of one dispatch took longer
+     *  than the budget, the remaining handlers below PRIORITY_HIGH are skipped for this dispatch and counted
+     *  in the deferred stat. They are never replayed later, so event callbacks (RecvPacket, CreateObj,
+     *  UpdateObj...) miss that event, Tick and Draw handlers just run again on the next dispatch.
+     *  @param fBudget budget in milliseconds, 0 disables it (default)
+     */
+    void SetBudget(string szCallback, float fBudget);
+    /// Sets the time budget of a callback list by ID
+    void SetBudget(int iCallback, float fBudget);
+    /**
+     *  @brief Returns the timing stats of every handler of a callback list
+     *  The wall time of each handler call is recorded into a histogram (1us - 10s, 3 significant digits).
+     *  @code
+     *  for _, s in ipairs(Callback.GetStats("Tick")) do
+     *      print(s.script, s.count, s.p50, s.p99, s.max, s.deferred)
+     *  end
+     *  @endcode
+     *  @return table with one entry per handler: fnc, script, count, deferred, min, max, mean,
+     *  p50, p90, p99 (milliseconds) and buckets ({ upper bound, count } pairs)
+     */
+    table GetStats(string szCallback);
+    /// Returns the timing stats of a callback list by ID
+    table GetStats(int iCallback);
+    /// Clears the timing stats of a callback list
+    void ResetStats(string szCallback);
+    /// Clears the timing stats of a callback list by ID
+    void ResetStats(int iCallback);
 }
 }
\ No newline at end of file
@@ -80,4 +80,59 @@ namespace Core {
          */
         Vector2 GetPos();
     }
+    /**
+     *  @brief Hierarchical frame profiler.
+     *  Tick, Draw and the other callbacks, render submission and lua GC are timed automatically
+     *  and attributed to the script that bound them. Scripts can add their own scopes.
+     *  @code
+     *  Core.Profiler.Enable(true)
+     *  Callback.Bind("Tick", function()
+     *      Core.Profiler.Begin("Prediction")
+     *      --code
+     *      Core.Profiler.End()
+     *  end)
+     *  Callback.Bind("Unload", function()
+     *      Core.Profiler.ExportTrace("trace.json")
+     *  end)
+     *  @endcode
+     */
+    namespace Profiler {
+        /// Enables or disables the profiler
+        void Enable(bool bEnable);
+        /// Returns if the profiler is enabled
+        bool IsEnabled();
+        /**
+         *  Opens a scope, nested inside the currently open one.
+         *  Scopes still open when the callback returns (or raises an error) are closed automatically.
+         *  @see End()
+         */
+        void Begin(string szName);
+        /**
+         *  Closes the last opened scope.
+         *  An End without an open scope of the current callback is ignored (and logged to the console).
+         *  @see Begin(string szName)
+         */
+        void End();
+        /// Sets the amount of frames kept in the ring buffer (default 300)
+        void SetHistory(int frames);
+        /**
+         *  @brief Returns a recorded frame
+         *  @param index 0 is the last frame, 1 the one before...
+         *  @return table of { name, script, start, duration, children } scopes, times in milliseconds
+         */
+        table GetFrame(int index = 0);
+        /**
+         *  @brief Returns the summary of a scope over the recorded frames
+         *  @param szName scope name, e.g. "Tick", "Draw", "Render", "GC" or a Begin name
+         *  @return table with count, avg, max, p50, p95 and p99 in milliseconds
+         */
+        table GetSummary(string szName);
+        /**
+         *  @brief Writes the recorded frames as Chrome trace JSON (chrome://tracing)
+         *  @return false if the file could not be written
+         */
+        bool ExportTrace(string szPath);
+        /// Clears the recorded frames
+        void Reset();
+    }
 }
\ No newline at end of file
@@ -9,19 +9,41 @@ namespace Geometry {
         */ 
         Vector2();
         /// Copy constructor of the vector
-        Vector2(Vector2 &v);
+        Vector2(const Vector2 &v);
         /// Default constructor, takes 2 axis
         Vector2(float x, float y);
         /// sum operator.
-        Vector2 operator +(Vector2 v);
+        Vector2 operator +(const Vector2 &v);
         /// subtraction operator.
-        Vector2 operator -(Vector2 v);
+        Vector2 operator -(const Vector2 &v);
         /// scaling operator.
         Vector2 operator *(float s);
         /// equality operator.
-        bool operator ==(Vector2 v);
+        bool operator ==(const Vector2 &v);
         /// division operator.
         Vector2 operator /(float s);
+        /**
+        *  @brief Sets the axis without creating a new vector
+        *  @return self
+        */
+        Vector2& Set(float x, float y);
+        /**
+        *  @brief Copies the axis of another vector without creating a new vector
+        *  @return self
+        */
+        Vector2& Set(const Vector2 &v);
+        /**
+        *  @brief Adds another vector to this one without creating a new vector
+        *  Same result as: self = self + v
+        *  @return self
+        */
+        Vector2& AddInPlace(const Vector2 &v);
+        /**
+        *  @brief Scales this vector without creating a new vector
+        *  Same result as: self = self * s
+        *  @return self
+        */
+        Vector2& ScaleInPlace(float s);
         /// returns the x axis.
         float x;
         /// returns the y axis.
@@ -52,52 +74,52 @@ namespace Geometry {
         *  Same as: (self - other):Length()
         *  @see Length()
         */
-        float DistanceTo(Vector2 other);
+        float DistanceTo(const Vector2 &other);
         /**
         *  @brief Returns a point in Barycentric coordinates, using the specified vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205485(v=vs.85).aspx
         */
-        Vector2 BaryCentric(Vector2 v2, Vector2 v3, float f, float g);
+        Vector2 BaryCentric(const Vector2 &v2, const Vector2 &v3, float f, float g);
         /**
         *  @brief Performs a Catmull-Rom interpolation, using the specified vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205506(v=vs.85).aspx
         */
-        Vector2 CatmullRom(Vector2 v1, Vector2 v2, Vector3 v3, float s);
+        Vector2 CatmullRom(const Vector2 &v1, const Vector2 &v2, const Vector3 &v3, float s);
         /**
         *  @brief Returns the z-component by taking the cross product of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205486(v=vs.85).aspx
         */
-        float CCW(Vector2 v2);
+        float CCW(const Vector2 &v2);
         /**
         *  @brief checks if counterclockwise
         *  @return > 0 if counterclockwise oriented, <0 if clockwise
         */
-        float CCW(Vector2 v2, Vector2 v3);
+        float CCW(const Vector2 &v2, const Vector2 &v3);
         /**
         *  @brief Determines the dot product of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205488(v=vs.85).aspx
         */
-        float Dot(Vector2 v2);
+        float Dot(const Vector2 &v2);
         /**
         *  @brief Performs a Hermite spline interpolation, using the specified vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205489(v=vs.85).aspx
         */
-        Vector2 Hermite(Vector2 t1, Vector2 v2, Vector2 t2, float s);
+        Vector2 Hermite(const Vector2 &t1, const Vector2 &v2, const Vector2 &t2, float s);
         /**
         *  @brief Performs a linear interpolation between two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205492(v=vs.85).aspx
         */
-        Vector2 Lerp(Vector2 v2, float s);
+        Vector2 Lerp(const Vector2 &v2, float s);
         /**
         *  @brief Returns a vector that is made up of the largest components of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205493(v=vs.85).aspx
         */
-        Vector2 Maximize(Vector2 v2);
+        Vector2 Maximize(const Vector2 &v2);
         /**
         *  @brief Returns a vector that is made up of the smallest components of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205494(v=vs.85).aspx
         */
-        Vector2 Minimize(Vector2 v2);
+        Vector2 Minimize(const Vector2 &v2);
         /**
         *  @brief Returns the normalized version of a vector.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205495(v=vs.85).aspx
@@ -107,17 +129,17 @@ namespace Geometry {
         *  @brief Transforms a vector by a given matrix.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205498(v=vs.85).aspx
         */
-        Vector4 Transform(Matrix4 m);
+        Vector4 Transform(const Matrix4 &m);
         /**
         * @brief Transforms a vector by a given matrix, projecting the result back into w = 1.
         * @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205500(v=vs.85).aspx
         */
-        Vector2 TransformCoord(Matrix4 m);
+        Vector2 TransformCoord(const Matrix4 &m);
         /**
         * @brief Transforms the vector normal by the given matrix.
         * @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205502(v=vs.85).aspx
         */
-        Vector2 TransformNormal(Matrix4 m);
+        Vector2 TransformNormal(const Matrix4 &m);
         /**
         *  @brief Scales a vector.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205496(v=vs.85).aspx
@@ -135,7 +157,7 @@ namespace Geometry {
         *  @brief Returns the z-component by taking the cross product of two vectors.
         *  @see CCW
         */
-        float Cross(Vector2 vs);
+        float Cross(const Vector2 &vs);
         /**
         *  @brief Returns the closest point to the line (infinite)
         *  @param a point on line
@@ -144,7 +166,7 @@ namespace Geometry {
         *  @return the point on the line
         *  @return a bool that tells if the point is in between point a and b
         */
-        Vector2 bool ProjectOnLine(Vector2 a, Vector2 b);
+        Vector2 bool ProjectOnLine(const Vector2 &a, const Vector2 &b);
         /**
         *  @brief Returns the closest point to the line segment
         *  @param a startpoint of line segment
@@ -153,7 +175,7 @@ namespace Geometry {
         *  @return the point on the line segment
         *  @return a bool that tells if the point is equals the point from ProjectOnLine
         */
-        Vector2 bool ProjectOnLineSegment(Vector2 a, Vector2 b);
+        Vector2 bool ProjectOnLineSegment(const Vector2 &a, const Vector2 &b);
         /**
         *  @brief Calculates interception points of moving target and particle with linear speed
         *  @param self startpoint of target
@@ -164,7 +186,7 @@ namespace Geometry {
         *  @param delay (optional) delay of particle in seconds
         *  @return time and positions of collision
         */
-        t1 p1 t2 p2 Interception(Vector2 endPoint, float speedTarget, Vector2 sourcePos, float sourceSpeed, float delay = 0);
+        t1 p1 t2 p2 Interception(const Vector2 &endPoint, float speedTarget, const Vector2 &sourcePos, float sourceSpeed, float delay = 0);
         /**
         *  @brief Calculates the intersection of two lines (infinite)
         *  @param self start of first line
@@ -173,7 +195,7 @@ namespace Geometry {
         *  @param v4 end of second line
         *  @return the intersection point or nil
         */
-        Vector2 Intersection(Vector2 v2, Vector2 v3, Vector2 v4);
+        Vector2 Intersection(const Vector2 &v2, const Vector2 &v3, const Vector2 &v4);
         /**
         *  @brief Checks if two line segments intersect
         *  may not be accurate in edge cases such as two lines on top of each other
@@ -183,21 +205,21 @@ namespace Geometry {
         *  @param v4 end of second line
         *  @return true if line segments intersect, false otherwise
         */
-        bool IsIntersection(Vector2 v2, Vector2 v3, Vector2 v4);
+        bool IsIntersection(const Vector2 &v2, const Vector2 &v3, const Vector2 &v4);
         /**
         *  @brief Checks if the Vector lies on a line segment.
         */
-        bool IsPartOfLineSegment(Vector2 v1, Vector2 v2);
+        bool IsPartOfLineSegment(const Vector2 &v1, const Vector2 &v2);
         /**
         *  @brief Gets the relative angle to the second vector using the origin
         *  @return the angle in rad
         */
-        double Angle(Vector2 v2 = {0, 0});
+        double Angle(const Vector2 &v2 = {0, 0});
         /**
         *  @brief Gets the relative angle to the second vector using the origin
         *  @return the angle in degree
         */
-        double AngleDeg(Vector2 v2 = {0, 0});
+        double AngleDeg(const Vector2 &v2 = {0, 0});
         /**
         *  Rotates the vector clockwise
         *  @param s angle in rad
@@ -220,19 +242,41 @@ namespace Geometry {
         */ 
         Vector3();
         /// Copy constructor of the vector
-        Vector3(Vector3 &v);
+        Vector3(const Vector3 &v);
         /// Default constructor, takes 2 axis
         Vector3(float x, float y, float z);
         /// sum operator.
-        Vector3 operator +(Vector3 v);
+        Vector3 operator +(const Vector3 &v);
         /// substraction operator.
-        Vector3 operator -(Vector3 v);
+        Vector3 operator -(const Vector3 &v);
         /// scaling operator.
         Vector3 operator *(float s);
         /// equality operator.
-        bool operator ==(Vector3 v);
+        bool operator ==(const Vector3 &v);
         /// division operator.
         Vector3 operator /(float s);
+        /**
+        *  @brief Sets the axis without creating a new vector
+        *  @return self
+        */
+        Vector3& Set(float x, float y, float z);
+        /**
+        *  @brief Copies the axis of another vector without creating a new vector
+        *  @return self
+        */
+        Vector3& Set(const Vector3 &v);
+        /**
+        *  @brief Adds another vector to this one without creating a new vector
+        *  Same result as: self = self + v
+        *  @return self
+        */
+        Vector3& AddInPlace(const Vector3 &v);
+        /**
+        *  @brief Scales this vector without creating a new vector
+        *  Same result as: self = self * s
+        *  @return self
+        */
+        Vector3& ScaleInPlace(float s);
         /// returns the x axis.
         float x;
         /// returns the y axis.
@@ -263,47 +307,47 @@ namespace Geometry {
         *  Same as: (self - other):Length()
         *  @see Length()
         */
-        float DistanceTo(Vector3 other);
+        float DistanceTo(const Vector3 &other);
         /**
         *  @brief Returns a point in Barycentric coordinates, using the specified vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205505(v=vs.85).aspx
         */
-        Vector3 BaryCentric(Vector3 v2, Vector3 v3, float f, float g);
+        Vector3 BaryCentric(const Vector3 &v2, const Vector3 &v3, float f, float g);
         /**
         *  @brief Performs a Catmull-Rom interpolation, using the specified vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205506(v=vs.85).aspx
         */
-        Vector3 CatmullRom(Vector3 v1, Vector3 v2, Vector3 v3, float s);
+        Vector3 CatmullRom(const Vector3 &v1, const Vector3 &v2, const Vector3 &v3, float s);
         /**
         *  @brief checks if counterclockwise (in topdown 2D)
         *  @return > 0 if counterclockwise oriented, <0 if clockwise
         */
-        float CCW(Vector3 v2, Vector3 v3);
+        float CCW(const Vector3 &v2, const Vector3 &v3);
         /**
         *  @brief Determines the dot product of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205508(v=vs.85).aspx
         */
-        float Dot(Vector3 v2);
+        float Dot(const Vector3 &v2);
         /**
         *  @brief Performs a Hermite spline interpolation, using the specified vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205509(v=vs.85).aspx
         */
-        Vector3 Hermite(Vector3 t1, Vector3 v2, Vector3 t2, float s);
+        Vector3 Hermite(const Vector3 &t1, const Vector3 &v2, const Vector3 &t2, float s);
         /**
         *  @brief Performs a linear interpolation between two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205512(v=vs.85).aspx
         */
-        Vector3 Lerp(Vector3 v2, float s);
+        Vector3 Lerp(const Vector3 &v2, float s);
         /**
         *  @brief Returns a vector that is made up of the largest components of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205513(v=vs.85).aspx
         */
-        Vector3 Maximize(Vector3 v2);
+        Vector3 Maximize(const Vector3 &v2);
         /**
         *  @brief Returns a vector that is made up of the smallest components of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205514(v=vs.85).aspx
         */
-        Vector3 Minimize(Vector3 v2);
+        Vector3 Minimize(const Vector3 &v2);
         /**
         *  @brief Returns the normalized version of a vector.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205515(v=vs.85).aspx
@@ -313,17 +357,17 @@ namespace Geometry {
         *  @brief Transforms a vector by a given matrix.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205520(v=vs.85).aspx
         */
-        Vector4 Transform(Matrix4 m);
+        Vector4 Transform(const Matrix4 &m);
         /**
         * @brief Transforms a vector by a given matrix, projecting the result back into w = 1.
         * @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205522(v=vs.85).aspx
         */
-        Vector3 TransformCoord(Matrix4 m);
+        Vector3 TransformCoord(const Matrix4 &m);
         /**
         * @brief Transforms the vector normal by the given matrix.
         * @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205524(v=vs.85).aspx
         */
-        Vector3 TransformNormal(Matrix4 m);
+        Vector3 TransformNormal(const Matrix4 &m);
         /**
         *  @brief Scales a vector.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205518(v=vs.85).aspx
@@ -337,7 +381,7 @@ namespace Geometry {
         *  @brief Determines the cross-product of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205507(v=vs.85).aspx
         */
-        float Cross(Vector3 v2);
+        float Cross(const Vector3 &v2);
         /**
         *  @brief Projects a 3D vector from object space into screen space.
         *  !Currently impossible to use!
@@ -362,19 +406,41 @@ namespace Geometry {
         */ 
         Vector4();
         /// Copy constructor of the vector
-        Vector4(Vector4 &v);
+        Vector4(const Vector4 &v);
         /// Default constructor, takes 2 axis
         Vector4(float x, float y, float z, float w);
         /// sum operator.
-        Vector4 operator +(Vector4 v);
+        Vector4 operator +(const Vector4 &v);
         /// substraction operator.
-        Vector4 operator -(Vector4 v);
+        Vector4 operator -(const Vector4 &v);
         /// scaling operator.
         Vector4 operator *(float s);
         /// equality operator.
-        bool operator ==(Vector4 v);
+        bool operator ==(const Vector4 &v);
         /// division operator.
         Vector4 operator /(float s);
+        /**
+        *  @brief Sets the axis without creating a new vector
+        *  @return self
+        */
+        Vector4& Set(float x, float y, float z, float w);
+        /**
+        *  @brief Copies the axis of another vector without creating a new vector
+        *  @return self
+        */
+        Vector4& Set(const Vector4 &v);
+        /**
+        *  @brief Adds another vector to this one without creating a new vector
+        *  Same result as: self = self + v
+        *  @return self
+        */
+        Vector4& AddInPlace(const Vector4 &v);
+        /**
+        *  @brief Scales this vector without creating a new vector
+        *  Same result as: self = self * s
+        *  @return self
+        */
+        Vector4& ScaleInPlace(float s);
         /// returns the x axis.
         float x;
         /// returns the y axis.
@@ -407,42 +473,42 @@ namespace Geometry {
         *  Same as: (self - other):Length()
         *  @see Length()
         */
-        float DistanceTo(Vector4 other);
+        float DistanceTo(const Vector4 &other);
         /**
         *  @brief Returns a point in Barycentric coordinates, using the specified vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205529(v=vs.85).aspx
         */
-        Vector4 BaryCentric(Vector4 v2, Vector4 v3, float f, float g);
+        Vector4 BaryCentric(const Vector4 &v2, const Vector4 &v3, float f, float g);
         /**
         *  @brief Performs a Catmull-Rom interpolation, using the specified vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205530(v=vs.85).aspx
         */
-        Vector4 CatmullRom(Vector4 v1, Vector4 v2, Vector4 v3, float s);
+        Vector4 CatmullRom(const Vector4 &v1, const Vector4 &v2, const Vector4 &v3, float s);
         /**
         *  @brief Determines the dot product of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205532(v=vs.85).aspx
         */
-        float Dot(Vector4 v2);
+        float Dot(const Vector4 &v2);
         /**
         *  @brief Performs a Hermite spline interpolation, using the specified vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205533(v=vs.85).aspx
         */
-        Vector4 Hermite(Vector4 t1, Vector4 v2, Vector4 t2, float s);
+        Vector4 Hermite(const Vector4 &t1, const Vector4 &v2, const Vector4 &t2, float s);
         /**
         *  @brief Performs a linear interpolation between two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205536(v=vs.85).aspx
         */
-        Vector4 Lerp(Vector4 v2, float s);
+        Vector4 Lerp(const Vector4 &v2, float s);
         /**
         *  @brief Returns a vector that is made up of the largest components of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205537(v=vs.85).aspx
         */
-        Vector4 Maximize(Vector4 v2);
+        Vector4 Maximize(const Vector4 &v2);
         /**
         *  @brief Returns a vector that is made up of the smallest components of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205538(v=vs.85).aspx
         */
-        Vector4 Minimize(Vector4 v2);
+        Vector4 Minimize(const Vector4 &v2);
         /**
         *  @brief Returns the normalized version of a vector.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205515(v=vs.85).aspx
@@ -452,7 +518,7 @@ namespace Geometry {
         *  @brief Transforms a vector by a given matrix.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205542(v=vs.85).aspx
         */
-        Vector4 Transform(Matrix4 m);
+        Vector4 Transform(const Matrix4 &m);
         /**
         *  @brief Scales a vector.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205540(v=vs.85).aspx
@@ -466,11 +532,175 @@ namespace Geometry {
         *  @brief Determines the cross-product of two vectors.
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205531(v=vs.85).aspx
         */
-        float Cross(Vector4 v2);
+        float Cross(const Vector4 &v2);
+    };
+
+    //!  Class representing a packed list of float results.
+    class FloatArray {
+    public:
+        /**
+        *  the size of the array with #
+        *  @code
+        *  for i = 1, #dist do
+        *      print(dist:Get(i))
+        *  end
+        *  @endcode
+        */
+        __len();
+        /// Gets a value from the array (1 based)
+        float Get(int index);
+        /// Sets a value inside the array (1 based)
+        void Set(int index, float value);
+        /// @return table representation
+        table ToTable();
+    };
+
+    /**
+    *  @brief Class representing a packed list of Vector2 (contiguous float storage).
+    *  The batch functions run on SSE/AVX2 kernels over the whole array in one call,
+    *  which is a lot cheaper than calling the Vector2 functions per element.
+    *  @code
+    *  local arr = Vector2Array.Reserve(#points)
+    *  for i = 1, #points do
+    *      arr:Add(points[i])
+    *  end
+    *  local dist = arr:DistanceTo(myPos)
+    *  @endcode
+    */
+    class Vector2Array {
+    public:
+        ///Default constructor
+        Vector2Array();
+        ///Copy constructor
+        Vector2Array(const Vector2Array &v);
+        ///Constructor that constructs a specific amount of zero vectors
+        Vector2Array(int size);
+        /**
+        *  Constructs an empty array and reserves space for x amount of vectors (does not add any vector)
+        */
+        static Vector2Array Reserve(int x);
+        /**
+        *  @brief returns the instruction set used by the batch kernels
+        *  @return "AVX2", "SSE2" or "scalar"
+        */
+        static string simd;
+        /**
+        *  the size of the array with #
+        *  @code
+        *  for i = 1, #arr do
+        *      print(arr:Get(i))
+        *  end
+        *  @endcode
+        */
+        __len();
+        /// Gets a copy of a vector in the array (1 based)
+        Vector2 Get(int index);
+        /// Sets a vector inside the array (1 based)
+        void Set(int index, const Vector2 &value);
+        /// Adds a vector to the array
+        void Add(const Vector2 &v);
+        /// Adds the vectors (Vector2 or objects accepted by Vector2.Copy) inside the list to the array
+        void Add(table t);
+        /// Clears every vector from the array (keeps the reserved space)
+        void Clear();
+        /**
+        *  @brief distance of every vector to another vector
+        *  Same as: arr:Get(i):DistanceTo(other) for every i
+        */
+        FloatArray DistanceTo(const Vector2 &other);
+        /**
+        *  @brief dot product of every vector with another vector
+        *  @see Vector2::Dot
+        */
+        FloatArray Dot(const Vector2 &v2);
+        /**
+        *  @brief Returns the normalized version of every vector.
+        *  @see Vector2::Normalize
+        */
+        Vector2Array Normalize();
+        /**
+        *  @brief the k vectors closest to a point
+        *  @return table with the indices of the k closest vectors, sorted by distance
+        */
+        table NearestK(const Vector2 &v, int k);
+        /**
+        *  @brief the vectors inside a circle
+        *  @return table with the indices of the vectors within radius (ascending)
+        */
+        table WithinRadius(const Vector2 &center, float radius);
+    };
+
+    /**
+    *  @brief Class representing a packed list of Vector3 (contiguous float storage).
+    *  The batch functions run on SSE/AVX2 kernels over the whole array in one call.
+    *  @see Vector2Array
+    */
+    class Vector3Array {
+    public:
+        ///Default constructor
+        Vector3Array();
+        ///Copy constructor
+        Vector3Array(const Vector3Array &v);
+        ///Constructor that constructs a specific amount of zero vectors
+        Vector3Array(int size);
+        /**
+        *  Constructs an empty array and reserves space for x amount of vectors (does not add any vector)
+        */
+        static Vector3Array Reserve(int x);
+        /**
+        *  @brief returns the instruction set used by the batch kernels
+        *  @return "AVX2", "SSE2" or "scalar"
+        */
+        static string simd;
+        /**
+        *  the size of the array with #
+        *  @code
+        *  for i = 1, #arr do
+        *      print(arr:Get(i))
+        *  end
+        *  @endcode
+        */
+        __len();
+        /// Gets a copy of a vector in the array (1 based)
+        Vector3 Get(int index);
+        /// Sets a vector inside the array (1 based)
+        void Set(int index, const Vector3 &value);
+        /// Adds a vector to the array
+        void Add(const Vector3 &v);
+        /// Adds the vectors (Vector3 or objects accepted by Vector3.Copy) inside the list to the array
+        void Add(table t);
+        /// Clears every vector from the array (keeps the reserved space)
+        void Clear();
+        /**
+        *  @brief distance of every vector to another vector
+        *  Same as: arr:Get(i):DistanceTo(other) for every i
+        */
+        FloatArray DistanceTo(const Vector3 &other);
+        /**
+        *  @brief dot product of every vector with another vector
+        *  @see Vector3::Dot
+        */
+        FloatArray Dot(const Vector3 &v2);
+        /**
+        *  @brief Returns the normalized version of every vector.
+        *  @see Vector3::Normalize
+        */
+        Vector3Array Normalize();
+        /**
+        *  @brief the k vectors closest to a point
+        *  @return table with the indices of the k closest vectors, sorted by distance
+        */
+        table NearestK(const Vector3 &v, int k);
+        /**
+        *  @brief the vectors inside a sphere
+        *  @return table with the indices of the vectors within radius (ascending)
+        */
+        table WithinRadius(const Vector3 &center, float radius);
     };
 
     /**
 *  @brief Class representing a 4x4 Matrix
+*  The components are stored 16 byte aligned, operator *, Determinant and Inverse use SSE.
 *  @see http://msdn.microsoft.com/de-de/library/windows/desktop/bb172912(v=vs.85).aspx
 */
     class Matrix4 {
@@ -705,6 +935,24 @@ namespace Geometry {
         *  @see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205368(v=vs.85).aspx
         */
         Matrix4 Transpose();
+        /**
+        *  @brief Transforms every point of the array by this matrix, projecting the results back into w = 1.
+        *  Same as: dst:Set(i, src:Get(i):TransformCoord(self)) for every i, in one SSE batch
+        *  @code
+        *  local viewProj = view * proj
+        *  viewProj:TransformPoints(worldPositions, ndcPositions) --normalized device coordinates (-1 to 1)
+        *  @endcode
+        *  @param src the points to transform
+        *  @param dst receives the transformed points, resized to #src. May be src itself to transform in place.
+        *  @see Vector3::TransformCoord
+        */
+        void TransformPoints(const Vector3Array &src, Vector3Array &dst);
+        /**
+        *  @brief Transforms every point of the array by this matrix
+        *  @return a new array with the transformed points
+        *  @see TransformPoints(const Vector3Array &src, Vector3Array &dst)
+        */
+        Vector3Array TransformPoints(const Vector3Array &src);
     };
 
     //!  Class representing Quaternions.
@@ -831,6 +1079,72 @@ namespace Geometry {
         */
         Axis Angle ToAxisAngle();
     };
+
+    /**
+    *  @brief Class representing a packed list of Quaternions.
+    *  The batch functions run on SSE kernels (scalar fallback on CPUs without SSE) over the whole array.
+    *  @see Vector3Array
+    */
+    class QuaternionArray {
+    public:
+        ///Default constructor
+        QuaternionArray();
+        ///Copy constructor
+        QuaternionArray(QuaternionArray &v);
+        ///Constructor that constructs a specific amount of identity quaternions
+        QuaternionArray(int size);
+        /**
+        *  Constructs an empty array and reserves space for x amount of quaternions (does not add any quaternion)
+        */
+        static QuaternionArray Reserve(int x);
+        /**
+        *  @brief returns the instruction set used by the batch kernels
+        *  @return "SSE2" or "scalar"
+        */
+        static string simd;
+        /**
+        *  the size of the array with #
+        *  @code
+        *  for i = 1, #arr do
+        *      print(arr:Get(i))
+        *  end
+        *  @endcode
+        */
+        __len();
+        /// Gets a copy of a quaternion in the array (1 based)
+        Quaternion Get(int index);
+        /// Sets a quaternion inside the array (1 based)
+        void Set(int index, Quaternion value);
+        /// Adds a quaternion to the array
+        void Add(Quaternion q);
+        /// Clears every quaternion from the array (keeps the reserved space)
+        void Clear();
+        /**
+        *  @brief Computes the unit length version of every quaternion.
+        *  @see Quaternion::Normalize
+        */
+        QuaternionArray Normalize();
+        /**
+        *  @brief Multiplies every quaternion with the one at the same index of other
+        *  @param other array with the same size, a different size raises an error
+        */
+        QuaternionArray Multiply(QuaternionArray other);
+        /**
+        *  @brief Interpolates every quaternion towards the one at the same index of Q2, using spherical linear interpolation.
+        *  @param Q2 array with the same size, a different size raises an error
+        *  @see Quaternion::Slerp
+        */
+        QuaternionArray Slerp(QuaternionArray Q2, float t);
+        /**
+        *  @brief Fast approximation of Slerp (normalized linear interpolation, shortest path).
+        *  The resulting rotation differs from Slerp by at most 0.01 degree if the two rotations
+        *  are 20 degree apart, 0.27 degree at 60, 2.3 degree at 120 and 8.2 degree at 180 (worst case).
+        *  The end points (t = 0 and t = 1) are exact.
+        *  @param Q2 array with the same size, a different size raises an error
+        *  @see Slerp
+        */
+        QuaternionArray Nlerp(QuaternionArray Q2, float t);
+    };
     
     //!  Class representing a rectangle
     class Rect {
@@ -905,8 +1219,14 @@ namespace Geometry {
         __len();
         /**
             *  @brief Draws the outline of the Polygon
+            *  The whole outline is built into one triangle strip, which is reused while the polygon is unchanged.
+            *  Changes (Add, Set, Clear, Reverse or writes through Get) are detected by a hash of the points,
+            *  width, join and miter_limit, compared on each call; the strip is rebuilt when it differs.
+            *  @param join nil draws every edge with butt ends (same output as before), otherwise the corners are joined
+            *  @param miter_limit JOIN_MITER corners longer than miter_limit * width / 2 are squared off
+            *  @see Render::Polyline
             */
-        void DrawOutline(float width, Graphics.Color color);
+        void DrawOutline(float width, Graphics.Color color, Clipper.JoinType join = nil, double miter_limit = 2);
         /**
             *  @brief the iterator of the points
             *  @code
@@ -1010,8 +1330,14 @@ namespace Geometry {
         __len();
         /**
             *  @brief Draws the outline of the Polygons
+            *  The whole outline is built into one triangle strip, which is reused while the polygons are unchanged.
+            *  Changes (Add, Set, Clear, Reverse or writes through Get) are detected by a hash of the points,
+            *  width, join and miter_limit, compared on each call; the strip is rebuilt when it differs.
+            *  @param join nil draws every edge with butt ends (same output as before), otherwise the corners are joined
+            *  @param miter_limit JOIN_MITER corners longer than miter_limit * width / 2 are squared off
+            *  @see Render::Polyline
             */
-        void DrawOutline(float width, Graphics.Color color);
+        void DrawOutline(float width, Graphics.Color color, Clipper.JoinType join = nil, double miter_limit = 2);
         /**
             *  @brief the iterator of the points
             *  @code
@@ -1021,6 +1347,21 @@ namespace Geometry {
             *  @endcode
             */
         iterator children;
+        /**
+            *  @brief the amount of worker threads used by Offset, Simplify, Clean and MinkowskiSum
+            *  The polygons are split across the worker pool. Clean works per polygon, its results are merged back
+            *  in input order. Offset, Simplify and MinkowskiSum only do the per polygon work (offsetting, building
+            *  the sums, splitting self intersections) on the workers, the final union over the merged results
+            *  (which joins overlapping outputs and keeps holes with their outer ring) runs on the calling thread,
+            *  so the result is the same as with a single thread.
+            *  Default is 1 (calling thread only), values above GetWorkerCount() are limited to GetWorkerCount().
+            *  @code
+            *  polys.threads = 4
+            *  local outline = polys:Offset(50, Clipper.JOIN_ROUND, Clipper.END_CLOSED, 2)
+            *  @endcode
+            *  @see SetWorkerCount(int count)
+            */
+        int threads;
         /**
             *  @brief the minkowski sum of the polygons
             *  @param self the polygons to calculate the Minkowski sum from
@@ -1068,6 +1409,79 @@ namespace Geometry {
         Polygons Offset(double delta, Clipper.JoinType jointype, Clipper.EndType endType, double miter_limit);
     };
 
+    /**
+    *  @brief Spatial index over a Polygons object for point in polygon queries.
+    *  Keeps the bounding box (Rect) of every polygon in a BVH and buckets the edges of each polygon,
+    *  so a query only tests the edges near the point instead of every edge of every polygon.
+    *  Inside is decided over the whole set with the fill type, like Clipper does: with EVEN_ODD (default)
+    *  a point inside a hole path is outside, with NON_ZERO, POSITIVE and NEGATIVE the winding of the
+    *  paths (orientation) decides.
+    *  @code
+    *  local index = PolygonIndex(walls)
+    *  local i = index:Find(Point(x, y))
+    *  if i then
+    *      print("inside polygon " .. i)
+    *  end
+    *  @endcode
+    */
+    class PolygonIndex {
+    public:
+        ///Builds the index from the polygons
+        PolygonIndex(Polygons polys, Clipper.PolyFillType fill = Clipper.EVEN_ODD);
+        ///Copy constructor
+        PolygonIndex(PolygonIndex &);
+        ///the amount of indexed polygons with #
+        __len();
+        ///Bounding Box of all indexed polygons
+        Geometry.Rect bounds;
+        ///gets and sets the fill type used by the queries
+        Clipper.PolyFillType fill;
+        /**
+        *  @brief Replaces a single polygon and only rebuilds its edge buckets and BVH path.
+        *  @param index index of the polygon (1 based)
+        *  @param poly the new polygon
+        */
+        void Update(int index, Polygon poly);
+        /// Adds a polygon to the index
+        void Add(Polygon poly);
+        /// Rebuilds the whole index from the polygons
+        void Rebuild(Polygons polys);
+        /**
+        *  @brief Checks a point against every indexed polygon
+        *  @return true if the point is inside (by the fill type) or on a boundary, false otherwise
+        *  @see Classify(Point p)
+        */
+        bool IsInside(Point p);
+        /**
+        *  @brief Checks every point of a polygon-array against the indexed polygons
+        *  @return table with the IsInside result (true / false) for every point
+        *  @see IsInside(Point p)
+        */
+        table IsInside(Polygon points);
+        /**
+        *  @brief Classifies a point against every indexed polygon
+        *  @return 0 if outside, 1 if inside (by the fill type) and -1 if the point is on a polygon boundary
+        *  @see Point::IsInside
+        */
+        int Classify(Point p);
+        /**
+        *  @brief Classifies every point of a polygon-array against the indexed polygons
+        *  @return table with the Classify result for every point
+        *  @see Classify(Point p)
+        */
+        table Classify(Polygon points);
+        /**
+        *  @brief Finds the polygon that contains the point (inside by the fill type or on the boundary)
+        *  @return index of the innermost outer (non-hole) path around the point or nil
+        */
+        int Find(Point p);
+        /**
+        *  @brief Finds the polygons that may intersect a rectangle
+        *  @return table with the indices of the polygons whose bounding box intersects rc
+        */
+        table Query(Geometry.Rect rc);
+    };
+
     //! Class for Polygon operations
     class Clipper {
     public:
@@ -1097,6 +1511,7 @@ namespace Geometry {
         const InitOptions REVERSE_SOLUTION;
         const InitOptions STRICTLY_SIMPLE;
         const InitOptions PRESERVE_COLLINEAR;
+        const InitOptions REUSE_MEMORY;
         ///Default constructor
         Clipper();
         ///Constructor takes options
@@ -1109,11 +1524,29 @@ namespace Geometry {
         bool reverseSolution;
         ///@see http://www.angusj.com/delphi/clipper/documentation/Docs/Units/ClipperLib/Classes/Clipper/Properties/PreserveCollinear.htm
         bool preserveCollinear;
+        /**
+        *  @brief Keeps the internal edge lists, local minima and output records in an arena across Execute calls.
+        *  Clear() only resets the arena, so Clear + Add + Execute does no heap allocation once it is big enough.
+        *  @code
+        *  local c = Clipper(Clipper.REUSE_MEMORY)
+        *  Callback.Bind("Tick", function()
+        *      c:Clear()
+        *      c:AddSubject(polys)
+        *      local result = c:Execute(c, Clipper.UNION)
+        *  end)
+        *  @endcode
+        *  @see Release()
+        */
+        bool reuseMemory;
+        ///returns the amount of heap allocations done by the last Execute
+        int allocations;
         ///@see http://www.angusj.com/delphi/clipper/documentation/Docs/Units/ClipperLib/Classes/Clipper/Methods/Execute.htm
         Polygons Execute(Clipper &clipper, ClipType clipType, PolyFillType subjFillType = EVEN_ODD, PolyFillType clipFillType = EVEN_ODD);
         ///Clears all added polygons
         ///@see http://www.angusj.com/delphi/clipper/documentation/Docs/Units/ClipperLib/Classes/ClipperBase/Methods/Clear.htm
         void Clear();
+        ///Clears all added polygons and frees the memory kept by reuseMemory
+        void Release();
         /**
         *  Adds a Polygon using PolyType SUBJECT
         *  @see AddPolygon
@@ -1145,4 +1578,34 @@ namespace Geometry {
         */
         void AddPolygons(Polygons polys, PolyType PolyTyp, bool Closed);
     };  
+
+    /**
+    *  @brief Number of vectors allocated since the last reset.
+    *  Vector2, Vector3 and Vector4 userdata are taken from a pooled allocator instead of
+    *  a separate heap allocation each, this counter includes every vector handed to lua.
+    *  @code
+    *  Callback.Bind("Draw", function()
+    *      Geometry.ResetAllocationCount()
+    *      --draw code
+    *      print(Geometry.GetAllocationCount())
+    *  end)
+    *  @endcode
+    *  @see ResetAllocationCount()
+    */
+    int GetAllocationCount();
+    /**
+    *  @brief Resets the vector allocation counter.
+    *  @see GetAllocationCount()
+    */
+    void ResetAllocationCount();
+    /// Returns the amount of free vector slots in the pool
+    int GetPoolFree();
+    /**
+    *  @brief Sets the size of the worker pool used by Polygons operations.
+    *  Default is the amount of cores - 1.
+    *  @see Polygons::threads
+    */
+    void SetWorkerCount(int count);
+    /// Returns the size of the worker pool
+    int GetWorkerCount();
 }
\ No newline at end of file
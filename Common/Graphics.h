@@ -5,6 +5,8 @@ namespace Graphics {
     //int FPUGetPrecision();
     //bool FPUGetPrecision(int iPrecision);
     //void SetProfilerMode(int iMode);
+    /// Returns the frames per second
+    /// @see Core::Profiler
     double GetProfilerFPS();
     /**
      *  @brief Color object, used in Draw functions
@@ -89,6 +91,75 @@ namespace Graphics {
              */
             a r g b unpack();
     };
+
+    /**
+     *  @brief Packed list of colors, for gradients and fades over many vertices.
+     *  The batch functions use SSE and give the same results as the Color functions (D3DX formulas).
+     *  @see Color
+     */
+    class ColorArray {
+        public:
+            /// Default constructor
+            ColorArray();
+            /// Copy constructor
+            ColorArray(ColorArray &v);
+            /// Constructs a specific amount of transparent black colors
+            ColorArray(int size);
+            /// Constructs an empty array and reserves space for x amount of colors
+            static ColorArray Reserve(int x);
+            /// returns the instruction set used by the batch kernels ("SSE2" or "scalar")
+            static string simd;
+            /// the size of the array with #
+            __len();
+            /// Gets a copy of a color in the array (1 based)
+            Color Get(int index);
+            /// Sets a color inside the array (1 based)
+            void Set(int index, Color value);
+            /// Adds a color to the array
+            void Add(Color c);
+            /// Adds a color from argb value 0 - 0xFFFFFFFF to the array
+            void Add(DWORD argb);
+            /// Clears every color from the array (keeps the reserved space)
+            void Clear();
+            /**
+             *  @brief Every color as 32bit ARGB number, channels are clamped to .0f - 1.0f
+             *  @return table with one number per color
+             *  @see Color::ToNumber
+             */
+            table ToNumbers();
+            /**
+             *  @brief Interpolates every color towards the one at the same index of C.
+             *  @param C array with the same size, a different size raises an error
+             *  @see Color::Lerp
+             */
+            ColorArray Lerp(ColorArray C, float s);
+            /**
+             *  @brief Interpolates every color towards C.
+             *  @see Color::Lerp
+             */
+            ColorArray Lerp(Color C, float s);
+            /**
+             *  @brief Blends every color with the one at the same index of C.
+             *  @param C array with the same size, a different size raises an error
+             *  @see Color::Modulate
+             */
+            ColorArray Modulate(ColorArray C);
+            /**
+             *  @brief Blends every color with C.
+             *  @see Color::Modulate
+             */
+            ColorArray Modulate(Color C);
+            /**
+             *  @brief Adjusts the saturation value of every color.
+             *  @see Color::AdjustSaturation
+             */
+            ColorArray AdjustSaturation(float s);
+            /**
+             *  @brief Adjusts the contrast value of every color.
+             *  @see Color::AdjustContrast
+             */
+            ColorArray AdjustContrast(float s);
+    };
     
     //!  Class used by BoL Sprites
     class Sprite {
@@ -99,13 +170,79 @@ namespace Graphics {
             void Draw(int x, int y);
             /// Draws the sprite
             void DrawEx(int x, int y, int idk);
-            /// Releases the sprite resources.
+            /**
+             *  @brief Releases the sprite resources.
+             *  The image is shared by every sprite loaded from the same content, the memory is only freed
+             *  when the last reference is released.
+             */
             void Release();
+            /**
+             *  @brief returns false while the image is decoded in the background (a placeholder is drawn)
+             *  Until then width and height are 0, page is -1 and region is empty.
+             *  @see ImageCache::SetAsync(bool bAsync)
+             */
+            bool loaded;
+            /// Blocks until the image is decoded (returns immediately if loaded), returns false if decoding failed
+            bool WaitLoaded();
+            /// returns the amount of sprites sharing the image
+            int refCount;
             /// returns the sprite width.
             int width;
             /// returns the sprite height.
             int height;
+            /// returns the atlas page the sprite image was packed into
+            int page;
+            /// returns the region of the sprite inside its atlas page (in pixels)
+            Geometry.Rect region;
     };
+    /**
+     *  @brief Texture atlas used by sprites.
+     *  Sprite images are packed into shared pages when they are loaded, the render manager
+     *  sorts sprites by page and draws every page with one call.
+     */
+    namespace Atlas {
+        /**
+         *  Sets the size of new atlas pages (default 2048).
+         *  Images larger than the page size get a page of their own with the size of the image.
+         */
+        void SetPageSize(int size);
+        /// Returns the amount of atlas pages
+        int GetPageCount();
+        /// Returns the 32bit ARGB pixels of an atlas page
+        Memory::MemoryBuffer GetPage(int page);
+        /**
+         *  @brief Decodes an image file to 32bit ARGB pixels without creating a texture.
+         *  @return pixels, width and height
+         */
+        Memory::MemoryBuffer int int Decode(string szPath);
+        /// Repacks every loaded sprite image, removing space of released sprites
+        void Repack();
+    }
+    /**
+     *  @brief Cache of decoded sprite images.
+     *  Images are keyed by a hash of the file content and reference counted, so loading the same file
+     *  twice decodes it once. By default images are decoded when the sprite is created, like before.
+     *  With SetAsync(true) decoding runs on a background thread pool and sprites draw a placeholder until
+     *  their image is ready.
+     */
+    namespace ImageCache {
+        /// Enables background decoding for sprites created afterwards (default false)
+        void SetAsync(bool bAsync);
+        /// Returns if background decoding is enabled
+        bool IsAsync();
+        /// Sets the amount of decode threads (default 2)
+        void SetDecodeThreads(int count);
+        /// Returns the amount of loads that reused a cached image
+        int GetHits();
+        /// Returns the amount of loads that had to decode the image
+        int GetMisses();
+        /// Returns the bytes of decoded images in memory
+        int GetBytesResident();
+        /// Returns the average decode time in milliseconds
+        double GetDecodeLatency();
+        /// Returns the amount of images waiting to be decoded
+        int GetPending();
+    }
     ///Creates a color from red, green, blue and alpha
     Color RGBA(int r, int g, int b, int a);
     ///Creates a color from alpha, red, green and blue
@@ -120,13 +257,39 @@ namespace Graphics {
     * @param x x position.
     * @param y y position.
     * @param color text color.
+    * @note The glyphs are taken from the font atlas and the layout from the TextCache.
     */
     void DrawText(string text, int fontSize, float x, float y, int color);
+    /**
+     *  @brief Layout cache used by DrawText and Render.Text.
+     *  Every font has a glyph atlas, laid out strings are kept by (font, size, text) and
+     *  least recently used entries are evicted. Cached runs are drawn as instanced quads.
+     */
+    namespace TextCache {
+        /// Sets the maximum amount of cached strings (default 4096)
+        void SetCapacity(int entries);
+        /// Returns the maximum amount of cached strings
+        int GetCapacity();
+        /// Returns the amount of cached strings
+        int GetCount();
+        /// Returns the amount of lookups that found a cached layout
+        int GetHits();
+        /// Returns the amount of lookups that had to lay out the string
+        int GetMisses();
+        /// Resets the hit and miss counters
+        void ResetStats();
+        /// Removes every cached layout and glyph atlas
+        void Clear();
+    }
     /// Draws a circle to the game screen
     void DrawCircle();
     /// Draws a line to the screen
     void DrawLine();
-    /// Draws lines to the screen
+    /**
+     *  @brief Draws lines to the screen
+     *  All segments of one call are built into a single triangle strip instead of one draw per segment.
+     *  @see Render::Polyline
+     */
     void DrawLines();
     /*
     /// Draws an arrow to the game screen
@@ -165,6 +165,47 @@ namespace Game {
     */
     Game::Unit ObjectByNetworkId(int networkID);
 
+    /**
+    * @brief Returns the snapshot of the world objects for the current tick.
+    * The snapshot is taken once per tick, the first call in a tick fills it.
+    * @see UnitSnapshot
+    */
+    Game::UnitSnapshot Snapshot();
+
+    /**
+    * @brief Uniform grid over the world object positions (Unit.pos).
+    * Objects are added, removed and moved by the CreateObj, DeleteObj and UpdateObj events,
+    * so a query only visits the cells that overlap the area instead of every object.
+    *
+    * @code
+    * for _, i in ipairs(Game.ObjectGrid.QueryRadius(myHero.pos, 1000)) do
+    *   local obj = Game.Object(i)
+    *   --Use the obj here
+    * end
+    * @endcode
+    *
+    * @see ObjectCount(), Object(int index)
+    */
+    namespace ObjectGrid {
+        /**
+        * @brief Returns the objects with a position inside the radius
+        * The distance is measured in the Vector3:To2D() plane (height is ignored), same as QueryRect.
+        * @return table with the Object(int index) indices (ascending), no unit userdata is created
+        */
+        table QueryRadius(Vector3 pos, float radius);
+        /**
+        * @brief Returns the objects with a position inside the rectangle (in the Vector3:To2D() plane)
+        * @return table with the Object(int index) indices (ascending)
+        */
+        table QueryRect(Geometry.Rect rc);
+        /// Sets the cell size in game units and rebuilds the grid
+        void SetCellSize(float size);
+        /// Returns the cell size in game units
+        float GetCellSize();
+        /// Returns the amount of objects in the grid
+        int Count();
+    }
+
 
     /**
     * @brief World hero list count
@@ -776,6 +817,73 @@ namespace Game {
             }
     };
     
+    /**
+    * @brief Struct-of-arrays copy of the commonly used Unit fields of every world object.
+    * Taken once per tick, the columns are contiguous so filters and sorts don't need a getter call per unit.
+    * Float fields are stored as Geometry.FloatArray, integer and boolean fields (networkID, team, visible...)
+    * as lua tables, so IDs keep their exact value.
+    * @code
+    * local snap = Game.Snapshot()
+    * local low = snap:Filter("visible", "==", true)
+    * low = snap:Filter("health", "<", 300, low)
+    * for _, i in ipairs(snap:Sort(low, "health")) do
+    *   print(snap:Unit(i).charName)
+    * end
+    * @endcode
+    * @see Snapshot()
+    */
+    class UnitSnapshot {
+        public:
+            /// returns the amount of units in the snapshot
+            int count;
+            /// returns the tick count the snapshot was taken at
+            int tick;
+            /// returns the Game.Object(int index) index of every row (table of integers)
+            table index;
+            /// returns the unit network IDs (table of integers)
+            table networkID;
+            /// returns the unit current health
+            Geometry.FloatArray health;
+            /// returns the unit maximum health
+            Geometry.FloatArray maxHealth;
+            /// returns the unit current mana
+            Geometry.FloatArray mana;
+            /// returns the unit maximum mana
+            Geometry.FloatArray maxMana;
+            /// returns the unit teams (table of Game.Team)
+            table team;
+            /// returns if the units are visible (table of booleans)
+            table visible;
+            /// returns if the units are dead (table of booleans)
+            table dead;
+            /// returns if the units are targetable (table of booleans)
+            table isTargetable;
+            /// returns the unit positions
+            Geometry.Vector3Array pos;
+            /// Returns the column of a field by name (Geometry.FloatArray, Geometry.Vector3Array or table)
+            object Column(string field);
+            /**
+            * @brief Filters the snapshot by a column
+            * @param field column name
+            * @param op one of "==", "~=", "<", "<=", ">", ">=" (only "==" and "~=" for boolean columns)
+            * @param value number or boolean to compare against
+            * @param indices (optional) only check these indices, e.g. the result of a previous Filter
+            * @return table with the matching rows (1 based, ascending)
+            */
+            table Filter(string field, string op, object value, table indices = nil);
+            /**
+            * @brief Sorts indices by a column
+            * @return the sorted table
+            */
+            table Sort(table indices, string field, bool descending = false);
+            /**
+            * @brief Returns the unit of a snapshot row
+            * @param row 1 based snapshot row, as returned by Filter and Sort (not the 0 based Game.Object index)
+            * @return the unit or nil if the object was deleted after the snapshot was taken
+            */
+            Game.Unit Unit(int row);
+    };
+
     //! Class obtained by ArchiveEntry content
     class IniBin {
         public:
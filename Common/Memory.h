@@ -1,11 +1,110 @@
 
 //!  Namespace with memory functions
 namespace Memory {
+    /**
+     *  @brief Bounds checked, read only view into a MemoryBuffer.
+     *  Does not copy the data, reading outside of the view raises an error.
+     *  @see MemoryBuffer::GetView(int offset, int nLen)
+     */
+    class MemoryView {
+        public:
+            ///returns the length of the view
+            int size;
+            ///Reads a 1byte unsigned integer at offset
+            BYTE ReadByte(int offset);
+            ///Reads a 2byte unsigned integer at offset
+            WORD ReadWord(int offset);
+            ///Reads a 4byte signed integer at offset
+            int ReadInt(int offset);
+            ///Reads a 4byte unsigned integer at offset
+            UINT ReadUInt(int offset);
+            ///Reads a 32bit floating point at offset
+            float ReadFloat(int offset);
+            ///Reads a null terminated ASCII string at offset
+            string ReadString(int offset);
+            ///Returns a view into this view
+            MemoryView GetView(int offset, int nLen);
+    };
     ///Class to read and write from memory
     class MemoryBuffer {
         public:
             ///Constructor, takes virtual address and length
             MemoryBuffer(int address, int nLen);
+            /**
+             *  @brief Constructor of a growable buffer, the Write functions grow it as needed.
+             *  The memory doubles on growth and is taken from a shared buffer pool.
+             *  @code
+             *  local out = Memory.MemoryBuffer()
+             *  for i = 1, #values do
+             *      out:WriteInt(values[i])
+             *  end
+             *  Utility.WriteBinary("values.bin", out)
+             *  @endcode
+             *  @param nCapacity initial capacity in bytes
+             */
+            MemoryBuffer(int nCapacity = 256);
+            ///returns if the buffer grows on writes
+            bool growable;
+            ///returns the allocated bytes of a growable buffer
+            int capacity;
+            ///Makes sure a growable buffer can hold nLen bytes without growing
+            void Reserve(int nLen);
+            /**
+             *  @brief returns the length of the buffer
+             *  For a growable buffer this is the end of the written data (the highest position written to),
+             *  moving position back does not shrink it. WriteBinary writes the first size bytes.
+             */
+            int size;
+            ///returns if the buffer is backed by a mapped file
+            ///@see Utility::MapBinary(string sPath, bool copyOnWrite)
+            bool mapped;
+            /**
+             *  @brief Closes the buffer, any later access raises an error
+             *  Mapped buffers are unmapped and growable buffers return their memory to the pool.
+             *  Buffers created with MemoryBuffer(int address, int nLen) do not own their memory, for them
+             *  Close only invalidates the object and never frees or unmaps the memory.
+             */
+            void Close();
+            /**
+             *  @brief Returns a bounds checked view into the buffer, without copying
+             *  Views and slices keep the offset into this buffer, not the address, so they stay valid when a
+             *  growable buffer reallocates. Accessing them after Close() raises an error.
+             */
+            MemoryView GetView(int offset, int nLen);
+            ///gets and sets the position
+            int position;
+            ///Returns a buffer over a part of this buffer, without copying (position starts at 0, it does not grow)
+            ///@see GetView(int offset, int nLen)
+            MemoryBuffer Slice(int offset, int nLen);
+            /**
+             *  @brief Reads n 4byte signed integers and increases position by 4 * n
+             *  The bulk reads (ReadInts, ReadUInts, ReadShorts, ReadFloats, ReadStruct) check the whole read against
+             *  the buffer length (nLen for address buffers) first. If it would run past the end they raise an error,
+             *  nothing is read and position does not move.
+             */
+            table ReadInts(int n, bool bigEndian = false);
+            ///Reads n 4byte unsigned integers and increases position by 4 * n
+            table ReadUInts(int n, bool bigEndian = false);
+            ///Reads n 2byte signed integers and increases position by 2 * n
+            table ReadShorts(int n, bool bigEndian = false);
+            ///Reads n 32bit floating points and increases position by 4 * n
+            Geometry.FloatArray ReadFloats(int n, bool bigEndian = false);
+            /**
+             *  @brief Reads count records and increases position by their size
+             *  The format uses the string.pack characters: b/B 1byte, h/H 2byte, i/I 4byte (signed/unsigned),
+             *  f float, d double, z null terminated string, x one padding byte, < little endian (default), > big endian.
+             *  @code
+             *  local buffer = Utility.ReadBinary("units.bin")
+             *  local count = buffer:ReadInt()
+             *  for _, rec in ipairs(buffer:ReadStruct("<Iffz", count)) do
+             *      print(rec[1], rec[2], rec[3], rec[4])
+             *  end
+             *  @endcode
+             *  @return table with one table per record
+             *  @see ReadInts(int n, bool bigEndian) for the bounds behaviour (z strings are checked while reading,
+             *  position is restored when one runs past the end)
+             */
+            table ReadStruct(string format, int count);
             ///Reads a 1byte unsigned integer and increases position by 1
             BYTE Read();
             ///Reads a 1byte signed integer and increases position by 1
@@ -22,6 +121,8 @@ namespace Memory {
             UINT ReadUInt();
             ///Reads a null terminated ASCII string and increases position by the size
             string ReadString();
+            ///Reads a 32bit floating point and increases position by 4
+            float ReadFloat();
             ///Writes a 1 byte unsigned integer and increases position by 1
             void Write(BYTE value);
             ///Writes a 1 byte signed integer and increases position by 1
@@ -38,6 +139,12 @@ namespace Memory {
             void WriteUInt(UINT value);
             ///Writes a null terminated string and increases position by the size
             void WriteString(string value);
+            ///Writes a 32bit floating point and increases position by 4
+            void WriteFloat(float value);
+            ///Writes the content of another buffer and increases position by its size
+            void WriteBuffer(MemoryBuffer buffer);
+            ///Writes the content of every buffer in the list (gather) and increases position by their sizes
+            void WriteBuffers(table buffers);
     };
     /**
     * Reads a 32bit integer from memory.
@@ -13,12 +13,75 @@ namespace Render {
             bool bHide;
             bool Show();
             bool Hide();
+            /**
+             *  @brief returns if the object is rebuilt on the next frame
+             *  Set by the object itself when a field is assigned (obj.text = ..., obj.pos = ..., SetRadius...).
+             *  Changes inside a vector field (obj.pos.x = 5, obj.pos:AddInPlace(v), obj.pos:Set(...)) can not
+             *  be seen by the object, call Invalidate() after them. Objects bound to a unit (GameCircle) are
+             *  rebuilt every frame.
+             *  @see Manager::retained
+             */
+            bool dirty;
+            /// Marks the object dirty, e.g. after changing a referenced Unit or Font
+            void Invalidate();
     };
 
-    //!  Class used by the render manager
+    /**
+     *  @brief Class used by the render manager
+     *  Added objects are collected into a command buffer each frame, sorted by texture, font and
+     *  primitive type, compatible primitives are merged into one vertex batch and submitted once.
+     */
     class Manager {
         public:
+            typedef int Backend;
+            /// Direct3D device of the game (default)
+            static const Backend DIRECT3D;
+            /// CPU rasterizer, renders into framebuffer without a GPU
+            static const Backend SOFTWARE;
+            /// Only records the submitted batches, nothing is drawn
+            static const Backend RECORD;
             void Add(Object obj);
+            /// Sets the backend the batches are submitted to
+            void SetBackend(Backend backend);
+            /// Sets the size of the SOFTWARE framebuffer
+            void SetViewport(int width, int height);
+            /**
+             *  @brief Builds and submits the command buffer.
+             *  The engine calls it automatically once per frame after the Draw callback, scripts don't need to.
+             *  Calling it from a script submits the objects collected so far right away; every object is
+             *  submitted at most once per frame, so the automatic Flush only submits what was added after it.
+             */
+            void Flush();
+            /// Merges compatible primitives into one batch, false submits one draw call per object
+            bool batching;
+            /**
+             *  @brief Retained mode, only dirty objects are re-tessellated and uploaded.
+             *  Unchanged objects replay their cached vertex range, hidden objects keep theirs.
+             *  Default is false (every object is rebuilt every frame, like before).
+             *  @see Object::dirty
+             */
+            bool retained;
+            /// returns the amount of objects rebuilt in the last frame
+            int rebuilt;
+            /// returns the amount of objects replayed from cache in the last frame
+            int reused;
+            /// returns the amount of draw calls of the last frame
+            int drawCalls;
+            /// returns the amount of state changes of the last frame
+            int stateChanges;
+            /// returns the amount of vertices of the last frame
+            int vertices;
+            /// returns the amount of vertices tessellated in the last frame (reused meshes are not counted)
+            int verticesGenerated;
+            /// returns the 32bit ARGB pixels of the SOFTWARE backend
+            Memory::MemoryBuffer framebuffer;
+            /**
+             *  @brief Returns the batches recorded in the last frame (SOFTWARE and RECORD backend)
+             *  @return table of { type = "triangles", page = n, font = id, vertices = n } entries in submit order.
+             *  page is the Graphics.Atlas page of sprite batches, font the glyph atlas id of text batches
+             *  (nil when the batch has no texture of that kind).
+             */
+            table GetCommands();
     };
     //!  Class used by text render objects
     class Text : public Object {
@@ -28,6 +91,8 @@ namespace Render {
             Text(string fontName, DWORD dwSize, DWORD x, DWORD y);
             Text(string fontName, DWORD dwSize, DWORD x, DWORD y, Font font);
             void Draw();
+            /// Returns the size of the text, measured from the cached layout
+            /// @see Graphics::TextCache
             Vector2 GetTextArea();
             string text;
             int argb;
@@ -44,12 +109,17 @@ namespace Render {
             int color1;
             int color2;
     };
-    //!  Class used by game circle render objects
+    /**
+     *  @brief Class used by game circle render objects
+     *  @see Circle
+     */
     class GameCircle : public Object {
         public:
             GameCircle(LoL.Unit unit, float fRange, int color);
             GameCircle(float x, float y, float z, float fRange, int color);
             void Draw();
+            /// Sets the segment count, 0 picks it from the on-screen radius (default)
+            void SetSegments(int segments);
             Unit unit;
             Vector3 pos;
             float radius;
@@ -59,14 +129,33 @@ namespace Render {
     class Sprite : public Object {
         public:
             Sprite(string path, int x, int y);
+            /// Creates a sprite from decoded 32bit ARGB pixels
+            /// @see Graphics::Atlas::Decode
+            Sprite(Memory::MemoryBuffer pixels, int width, int height, int x, int y);
             void Draw();
+            /**
+             *  Draws a part of the image.
+             *  srcRect is in pixels of the sprite image (0, 0 is its top left corner), it is offset by the sprite
+             *  region inside its atlas page and clipped to the region, so it never samples a neighbouring image.
+             */
             void DrawEx(D3DRECT srcRect, Vector3 pCenter, Vector3 pPosition);
             void SetScale(float xScale, float yScale);
             string path;
             Vector2 pos;
+            /// returns the atlas page the image was packed into
+            int page;
+            /// returns false while the image is decoded in the background (only with Graphics.ImageCache.SetAsync(true))
+            /// @see Graphics::Sprite::loaded
+            bool loaded;
+            /// Blocks until the image is decoded, returns false if decoding failed
+            bool WaitLoaded();
 
     };
-    //!  Class used by circle render objects
+    /**
+     *  @brief Class used by circle render objects
+     *  The unit circle mesh is cached by segment count and ring ratio (minRadius / maxRadius)
+     *  and only transformed per circle, all circles sharing a mesh are drawn in one instanced call.
+     */
     class Circle : public Object {
         public:
             Circle(float x, float y, float z, int minRadius, int maxRadius, int innerColor, int outerColor);
@@ -79,12 +168,19 @@ namespace Render {
             void SetColor(int InnerColor, int OuterColor);
             void SetRadius(int radius);
             void SetRadius(int minRadius, int maxRadius);
+            /// Sets the segment count, 0 picks it from the on-screen radius (default)
+            void SetSegments(int segments);
             //Unit unit;
             //Vector3 pos;
             //float radius;
             //int color;
     };
-    //! Class used to render lines
+    /**
+     *  @brief Class used to render lines
+     *  Lines are drawn through the polyline path, lines with the same width and color are
+     *  submitted as one strip.
+     *  @see Polyline
+     */
     class Line : public Object {
         public:
             Line(Vector2 start, Vector2 end, float width, number Color);
@@ -94,4 +190,38 @@ namespace Render {
             float width;
             number color;
     };
+    /**
+     *  @brief Class used to render polylines
+     *  The outline is built into a single triangle strip with the given join style, and the strip
+     *  is only rebuilt when the geometry, width or join changes.
+     *  @code
+     *  local outline = Render.Polyline(polys, 2, 0xFFFF0000)
+     *  Render.Manager:Add(outline)
+     *  @endcode
+     */
+    class Polyline : public Object {
+        public:
+            Polyline(Geometry.Polygon poly, float width, number color);
+            Polyline(Geometry.Polygon poly, float width, number color, Geometry.Clipper.JoinType join);
+            Polyline(Geometry.Polygon poly, float width, number color, Geometry.Clipper.JoinType join, double miter_limit);
+            Polyline(Geometry.Polygons polys, float width, number color);
+            Polyline(Geometry.Polygons polys, float width, number color, Geometry.Clipper.JoinType join);
+            Polyline(Geometry.Polygons polys, float width, number color, Geometry.Clipper.JoinType join, double miter_limit);
+            Polyline(table points, float width, number color, bool closed);
+            void Draw();
+            /// Replaces the geometry (copied, later changes to poly are not seen), the strip is rebuilt on the next Draw
+            void SetPolygon(Geometry.Polygon poly);
+            /// Replaces the geometry (copied, later changes to polys are not seen), the strip is rebuilt on the next Draw
+            void SetPolygons(Geometry.Polygons polys);
+            float width;
+            number color;
+            /// corner join style, nil draws every segment with butt ends like Line (default)
+            Geometry.Clipper.JoinType join;
+            /// JOIN_MITER corners longer than miter_limit * width / 2 are squared off (default 2)
+            double miter_limit;
+            /// connects the last point with the first one (always true for Polygon and Polygons)
+            bool closed;
+            /// returns the amount of vertices of the strip
+            int vertexCount;
+    };
 }
@@ -43,6 +43,13 @@ namespace Keyboard {
 namespace Utility {
     /**
      *  @brief returns a table that is saved on exit and loaded on start.
+     *  The save stays a plain lua table (no proxy or metatable), so pairs, next, #, table.insert and rawset
+     *  keep working. Changes are found by comparing the table (also nested tables) against a copy of the last
+     *  written values once per flush interval on the game thread; the changed keys are then appended to a
+     *  journal by a background thread. Every change is caught this way, also ones made by rawset or table.insert.
+     *  The journal is compacted into the snapshot once it grows bigger than the snapshot.
+     *  Loading replays the snapshot and then the journal, so exit only writes the last changes
+     *  and a crash loses at most one flush interval.
      *  It has the following preset functions:
      *  @code 
      *  save = GetSave("MySave")
@@ -51,9 +58,40 @@ namespace Utility {
      *  save:Remove() --deletes the file (still getting saved afterwards if not cleared)
      *  save:Clear() --clears the table
      *  save:IsEmpty() --returns true if it has no content
+     *  save:Flush() --writes the pending changes to the journal now
+     *  save:SetFlushInterval(1000) --sets the flush interval in milliseconds (default 1000, 0 only flushes on Flush and exit)
+     *  save:Compact() --rewrites the snapshot and clears the journal
+     *  save:Stats() --returns a table with pending, journalBytes and snapshotBytes
      *  @endcode
+     *  The snapshot is written in the binary format of EncodeTable, saves in the old text format
+     *  are converted when they are loaded.
+     *  @see EncodeTable(table t), ConvertSave(string name)
      */
     table GetSave(string name);
+    /**
+     *  @brief Encodes a table to the versioned binary save format.
+     *  Whole numbers up to 2^53 are stored as zigzag varints (small negative numbers stay small), other
+     *  numbers as 8 byte doubles, booleans as one byte. Geometry.Vector2, Vector3 and Vector4 are stored as
+     *  native floats. Keys can be strings (interned, every key string is written once), numbers or booleans,
+     *  entries with other keys and values of other types (functions, other userdata) are skipped.
+     *  A sub-table referenced from several places is written at every place (it decodes as separate copies),
+     *  a table that contains itself (a cycle) is an error.
+     *  @see DecodeTable(Memory::MemoryBuffer buffer)
+     *  @return growable memory buffer with the encoded table, or nil and the error message (e.g. the key path of a cycle)
+     */
+    Memory::MemoryBuffer string EncodeTable(table t);
+    /**
+     *  @brief Decodes a table from the binary save format.
+     *  The buffer is decoded while it is read, starting at its position.
+     *  @see EncodeTable(table t)
+     *  @return the decoded table or nil and the error message
+     */
+    table string DecodeTable(Memory::MemoryBuffer buffer);
+    /**
+     *  @brief Converts a save from the old text format to the binary format without loading it.
+     *  @return false if the save does not exist or is already binary
+     */
+    bool ConvertSave(string name);
     ///Checks if a file exists on the file system
     bool FileExists(std::string sPath);
     /**
@@ -78,12 +116,31 @@ namespace Utility {
     */
     Memory::MemoryBuffer ReadBinary(string sPath);
     /**
+    * @brief Maps a file into memory instead of reading it.
+    * The pages are loaded on first access, so this takes the same time for any file size.
+    * Call Close() on the buffer to unmap the file before it is garbage collected.
+    * @see ReadBinary(string sPath)
+    * @param sPath path to file.
+    * @param copyOnWrite false maps read only (writes raise an error), true maps copy on write (writes are not saved to the file).
+    * @return Memory buffer backed by the file
+    */
+    Memory::MemoryBuffer MapBinary(string sPath, bool copyOnWrite = false);
+    /**
     * @brief Saves a memory buffer to file.
+    * The buffer is written without a copy to a temporary file which then replaces the file,
+    * so the file is never left half written.
     * @see ReadFile(string sPath)
     * @param sPath path to file.
     * @param buffer buffer to write.
     */
     void WriteBinary(string szPath, Memory.MemoryBuffer buffer);
+    /**
+    * @brief Saves a list of memory buffers to one file (gather write).
+    * @see WriteBinary(string szPath, Memory.MemoryBuffer buffer)
+    * @param sPath path to file.
+    * @param buffers list of buffers to write in order.
+    */
+    void WriteBinary(string szPath, table buffers);
     namespace Base64 {
         /**
         * @brief Encodes a string to base64.